@@ -7,7 +7,12 @@
  */
 class Customer {
  public:
-  double arrival_time;  ///< Time when customer arrived
+  double arrival_time = 0.0;  ///< Time when customer arrived
+
+  /**
+   * @brief Constructs a customer with arrival time 0 (e.g. for containers).
+   */
+  Customer() = default;
 
   /**
    * @brief Constructs a customer with given arrival time.
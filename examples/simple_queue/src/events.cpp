@@ -0,0 +1,21 @@
+#include "events.h"
+
+#include <memory>
+
+#include "customer.h"
+
+void ArrivalEvent::Action(desvu::Simulator& sim) {
+  // Create new customer and delegate to server
+  Customer new_customer(sim.Now());
+  server_->HandleArrival(new_customer);
+
+  // Schedule next arrival, reusing this event object instead of
+  // allocating a fresh one for every step of the arrival chain
+  sim.Reschedule(this, config_.NextInterarrivalTime());
+}
+
+void ServiceCompletionEvent::Action(desvu::Simulator& sim) {
+  // Delegate to server to handle service completion; the server may reuse
+  // this event for the next customer's completion
+  server_->HandleServiceCompletion(this);
+}
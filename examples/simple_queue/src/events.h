@@ -13,8 +13,11 @@
  * When a customer arrives:
  * 1. Delegate to Server
  * 2. Schedule the next arrival
+ *
+ * Pooled so that repeated allocations recycle the same storage.
  */
-class ArrivalEvent : public desvu::Event {
+class ArrivalEvent : public desvu::Event,
+                     public desvu::PooledEvent<ArrivalEvent> {
  private:
   Server* server_;            ///< Pointer to the server
   SimulationConfig& config_;  ///< Reference to simulation configuration
@@ -38,8 +41,12 @@ class ArrivalEvent : public desvu::Event {
  * When a customer completes service:
  * 1. Increment departure counter
  * 2. Delegate to Server to handle service completion
+ *
+ * Pooled so that repeated allocations recycle the same storage.
  */
-class ServiceCompletionEvent : public desvu::Event {
+class ServiceCompletionEvent
+    : public desvu::Event,
+      public desvu::PooledEvent<ServiceCompletionEvent> {
  private:
   Server* server_;  ///< Pointer to the server
 
@@ -26,6 +26,7 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 #include "events.h"
 #include "server.h"
@@ -55,9 +56,7 @@ SimRunResults RunSimulation(SimulationConfig& config, bool verbose = false) {
 
   // Schedule first arrival
   double first_delay = config.NextInterarrivalTime();
-  auto first_arrival =
-      std::make_shared<ArrivalEvent>(first_delay, &server, config);
-  sim.Schedule(first_arrival);
+  sim.Schedule(std::make_unique<ArrivalEvent>(first_delay, &server, config));
 
   // Run simulation
   sim.Run(config.sim_time);
@@ -102,17 +101,24 @@ int main() {
                           0         // random seed
   );
 
-  // Run multiple simulation runs
-  desvu::StatsCollector stats;
+  // Run multiple simulation runs. Each run is fully independent (own
+  // seed, own Simulator/Server), so the loop parallelizes trivially;
+  // results are stored per index to keep the output deterministic.
   const int num_runs = 100;
+  std::vector<SimRunResults> results(num_runs);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
   for (int i = 0; i < num_runs; ++i) {
-
     // Run simulation with config with new seed i
     SimulationConfig run_config(config.sim_time, config.arrival_rate,
                                 config.service_rate, i);
-    auto run_stats = RunSimulation(run_config, false);
+    results[i] = RunSimulation(run_config, false);
+  }
 
-    // Store statistics from this run
+  // Aggregate run results serially (StatsCollector is not thread-safe)
+  desvu::StatsCollector stats;
+  for (const auto& run_stats : results) {
     stats.Add("Mean Waiting Time", run_stats.mean_waiting_time);
     stats.Add("Mean Queue Length", run_stats.mean_queue_length);
   }
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Contiguous FIFO ring buffer with power-of-two capacity.
+ *
+ * Replacement for std::queue (deque-backed) on the simulation hot path:
+ * all waiting customers live in one contiguous allocation, Push/Pop are a
+ * store/load plus an index mask, and the buffer only reallocates on the
+ * rare occasion the queue outgrows its capacity (doubling, preserving
+ * FIFO order). For an M/M/1 queue with rho < 1 the expected queue length
+ * is bounded, so after warm-up the buffer never reallocates and typically
+ * fits in a handful of cache lines.
+ */
+template <typename T>
+class RingBuffer {
+ public:
+  /**
+   * @brief Constructs an empty ring buffer.
+   * @param initial_capacity Initial capacity (rounded up to a power of two)
+   */
+  explicit RingBuffer(std::size_t initial_capacity = 64)
+      : head_(0), tail_(0) {
+    std::size_t capacity = 1;
+    while (capacity < initial_capacity) capacity <<= 1;
+    slots_.resize(capacity);
+  }
+
+  /**
+   * @brief Checks whether the buffer is empty.
+   * @return true if no elements are stored
+   */
+  bool Empty() const { return head_ == tail_; }
+
+  /**
+   * @brief Returns the number of stored elements.
+   * @return Element count
+   */
+  std::size_t Size() const { return head_ - tail_; }
+
+  /**
+   * @brief Appends an element at the back.
+   * @param value The element to append
+   */
+  void Push(const T& value) {
+    if (Size() == slots_.size()) Grow();
+    slots_[head_++ & (slots_.size() - 1)] = value;
+  }
+
+  /**
+   * @brief Accesses the oldest element.
+   * @return Reference to the front element
+   */
+  T& Front() { return slots_[tail_ & (slots_.size() - 1)]; }
+
+  /**
+   * @brief Removes the oldest element.
+   */
+  void Pop() { ++tail_; }
+
+ private:
+  /**
+   * @brief Doubles the capacity, preserving FIFO order.
+   */
+  void Grow() {
+    std::vector<T> bigger(slots_.size() * 2);
+    std::size_t count = Size();
+    for (std::size_t i = 0; i < count; ++i) {
+      bigger[i] = slots_[(tail_ + i) & (slots_.size() - 1)];
+    }
+    slots_.swap(bigger);
+    tail_ = 0;
+    head_ = count;
+  }
+
+  std::vector<T> slots_;  ///< Storage; size is always a power of two
+  std::size_t head_;      ///< Monotonic write position
+  std::size_t tail_;      ///< Monotonic read position
+};
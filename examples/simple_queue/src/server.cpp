@@ -0,0 +1,60 @@
+#include "server.h"
+
+#include <memory>
+
+#include "events.h"
+
+Server::Server(desvu::Simulator& sim, SimulationConfig& config)
+    : sim_(sim),
+      config_(config),
+      is_busy_(false),
+      stats_(),
+      waiting_time_stat_(&stats_.GetOrCreateEvent("Waiting Time")),
+      queue_length_stat_(&stats_.GetOrCreateTimeWeighted("Queue Length")),
+      utilization_stat_(
+          &stats_.GetOrCreateTimeWeighted("Server Utilization")) {}
+
+void Server::HandleArrival(const Customer& customer) {
+  const double now = sim_.Now();
+  if (is_busy_) {
+    // Server is busy - join the queue
+    queue_.Push(customer);
+    queue_len_ += 1.0;
+    queue_length_stat_->Update(now, queue_len_);
+  } else {
+    // Server is idle - start service immediately
+    is_busy_ = true;
+    utilization_stat_->Update(now, 1.0);
+    waiting_time_stat_->Add(0.0);
+
+    ScheduleServiceCompletion();
+  }
+}
+
+void Server::HandleServiceCompletion(desvu::Event* completion_event) {
+  const double now = sim_.Now();
+  if (queue_.Empty()) {
+    // No one waiting - server becomes idle
+    is_busy_ = false;
+    utilization_stat_->Update(now, 0.0);
+  } else {
+    // Serve next customer in queue
+    Customer next_customer = queue_.Front();
+    queue_.Pop();
+    queue_len_ -= 1.0;
+    queue_length_stat_->Update(now, queue_len_);
+
+    // Calculate and record waiting time
+    double waiting_time = next_customer.WaitingTime(now);
+    waiting_time_stat_->Add(waiting_time);
+
+    // Reuse the completion event that just fired for the next customer
+    sim_.Reschedule(completion_event, config_.NextServiceTime());
+  }
+}
+
+void Server::ScheduleServiceCompletion() {
+  double service_time = config_.NextServiceTime();
+  sim_.Schedule(std::make_unique<ServiceCompletionEvent>(service_time, this));
+}
+
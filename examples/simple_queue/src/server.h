@@ -2,9 +2,8 @@
 
 #include <desvu/desvu.h>
 
-#include <queue>
-
 #include "customer.h"
+#include "ring_buffer.h"
 #include "simulation_config.h"
 
 /**
@@ -17,12 +16,19 @@
  */
 class Server {
  private:
-  std::queue<Customer> queue_;        ///< FIFO queue of waiting customers
+  RingBuffer<Customer> queue_;        ///< FIFO queue of waiting customers
+  double queue_len_ = 0.0;            ///< Queue length, cached as double
   bool is_busy_;                      ///< Whether server is currently serving
   SimulationConfig& config_;          ///< Reference to simulation config.
   desvu::Simulator& sim_;             ///< Reference to simulator
   desvu::StatsCollector stats_;       ///< Statistics collector
 
+  // Cached statistic handles, resolved once at construction so the
+  // per-event handlers skip the name lookup in the collector
+  desvu::EventStats* waiting_time_stat_;           ///< "Waiting Time"
+  desvu::TimeWeightedStats* queue_length_stat_;    ///< "Queue Length"
+  desvu::TimeWeightedStats* utilization_stat_;     ///< "Server Utilization"
+
  public:
   /**
    * @brief Constructs a server.
@@ -45,9 +51,12 @@ class Server {
    * @brief Handles service completion.
    *
    * If queue is empty, server becomes idle.
-   * Otherwise, starts serving the next customer in queue.
+   * Otherwise, starts serving the next customer in queue, reusing the
+   * completion event that just fired for the next completion.
+   *
+   * @param completion_event The service completion event that just fired
    */
-  void HandleServiceCompletion();
+  void HandleServiceCompletion(desvu::Event* completion_event);
 
   /**
    * @brief Schedules a service completion event.
@@ -61,7 +70,7 @@ class Server {
    * @brief Returns the current queue length.
    * @return Number of customers waiting in queue
    */
-  size_t QueueLength() const { return queue_.size(); }
+  size_t QueueLength() const { return queue_.Size(); }
 
   /**
    * @brief Checks if the server is busy.
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <random>
+#include <desvu/desvu.h>
 
 /**
  * @brief Centralized configuration for the M/M/1 queue simulation.
@@ -9,18 +9,18 @@
  * for the discrete event simulation.
  */
 struct SimulationConfig {
-  // Simulation parameters
-  double sim_time;  ///< Total simulation time
-  double arrival_rate;     ///< Customer arrival rate (λ)
-  double service_rate;     ///< Service rate (μ)
+  // Simulation parameters, fixed for the lifetime of a run. Because the
+  // rates cannot change after construction, the generators below bake
+  // the -1/rate multiplier in once at construction time.
+  const double sim_time;      ///< Total simulation time
+  const double arrival_rate;  ///< Customer arrival rate (λ)
+  const double service_rate;  ///< Service rate (μ)
 
-  // Random number generation per stream for Common Random Numbers
-  std::mt19937 arrival_rng;  ///< RNG for arrivals
-  std::mt19937 service_rng;  ///< RNG for service times
-
-  // Specify distributions
-  std::exponential_distribution<double> interarrival_dist;
-  std::exponential_distribution<double> service_dist;
+  // Random number generation per stream for Common Random Numbers.
+  // Block-based generators amortize the engine and log() cost over
+  // 1024 variates at a time instead of paying it per event.
+  desvu::BatchedExponential interarrival_gen;  ///< Interarrival times
+  desvu::BatchedExponential service_gen;       ///< Service times
 
   /**
    * @brief Constructs simulation configuration for M/M/1 queue.
@@ -42,22 +42,20 @@ struct SimulationConfig {
       : sim_time(sim_time),
         arrival_rate(arrival_rate),
         service_rate(service_rate),
-        arrival_rng(seed),
-        service_rng(seed + 11),  // + 11 to have different seeds
-        interarrival_dist(arrival_rate),
-        service_dist(service_rate) {}
+        interarrival_gen(arrival_rate, seed),
+        service_gen(service_rate, seed + 11) {}  // + 11: different streams
 
   /**
    * @brief Generates next inter-arrival time from exponential distribution.
    * @return Random time until next customer arrival
    */
-  double NextInterarrivalTime() { return interarrival_dist(arrival_rng); }
+  double NextInterarrivalTime() { return interarrival_gen.Next(); }
 
   /**
    * @brief Generates service time from exponential distribution.
    * @return Random service duration for a customer
    */
-  double NextServiceTime() { return service_dist(service_rng); }
+  double NextServiceTime() { return service_gen.Next(); }
 
   /**
    * @brief Gets the traffic intensity (ρ = λ/μ).
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace desvu {
+
+/**
+ * @brief Calendar queue: an amortized O(1) priority queue for event times.
+ *
+ * A calendar queue (Brown, 1988) hashes events into "day" buckets by
+ * their timestamp, like appointments in a desk calendar. When event time
+ * increments are small and fairly regular — the typical discrete event
+ * simulation workload, where each event schedules successors a short
+ * exponential delay ahead — insert and pop-min each touch about one
+ * bucket, versus O(log n) sift operations for a binary heap.
+ *
+ * The queue tunes itself: when the number of stored events grows past
+ * twice the bucket count (or shrinks below half) the calendar is rebuilt
+ * with a new bucket count and a bucket width estimated from the current
+ * average event spacing.
+ *
+ * Entry is any type with public `time` (double) and `id` (integral)
+ * members; entries are ordered by (time, id), so insertion order breaks
+ * ties exactly like the simulator's heap.
+ *
+ * Timestamps must not decrease below the last popped time, which holds
+ * for simulation schedules (events are always scheduled at or after the
+ * current time).
+ */
+template <class Entry>
+class CalendarQueue {
+ public:
+  /**
+   * @brief Constructs an empty calendar queue.
+   * @param initial_width Initial bucket width (a rough guess at the mean
+   *        spacing between event times; the queue retunes on resize)
+   */
+  explicit CalendarQueue(double initial_width = 1.0)
+      : size_(0),
+        width_(initial_width > 0.0 ? initial_width : 1.0),
+        last_time_(0.0) {
+    buckets_.resize(kMinBuckets);
+    SetScanPosition(0.0);
+  }
+
+  /**
+   * @brief Checks whether the queue is empty.
+   * @return true if no entries are stored
+   */
+  bool Empty() const { return size_ == 0; }
+
+  /**
+   * @brief Returns the number of stored entries.
+   * @return Entry count
+   */
+  std::size_t Size() const { return size_; }
+
+  /**
+   * @brief Pre-sizes the calendar for an expected number of entries.
+   *
+   * Grows the bucket array up front so that the first resize thresholds
+   * are not hit while filling to the expected size. The argument is the
+   * number of entries expected to be pending at once, not the total
+   * processed over a run.
+   *
+   * @param expected_entries Expected simultaneous entry count
+   */
+  void Reserve(std::size_t expected_entries) {
+    std::size_t target = kMinBuckets;
+    while (2 * target < expected_entries) target *= 2;
+    if (target > buckets_.size()) Resize(target);
+  }
+
+  /**
+   * @brief Inserts an entry, keeping its bucket sorted.
+   * @param entry The entry to insert (must have time >= last popped time)
+   */
+  void Push(Entry entry) {
+    // A peek (or a resize) may have advanced the scan to the day of the
+    // then-minimum entry, but pushed times only have to be >= the last
+    // *popped* time — so a new entry may legally land on an earlier day.
+    // Rewind the scan to it, or PopMin would skip it and return a later
+    // entry first. The current day spans [bucket_top_ - width_,
+    // bucket_top_), so anything before its start is behind the scan.
+    if (entry.time < bucket_top_ - width_) {
+      SetScanPosition(entry.time);
+    }
+    auto& bucket = buckets_[BucketIndex(entry.time)];
+    auto pos = std::upper_bound(bucket.begin(), bucket.end(), entry,
+                                [](const Entry& a, const Entry& b) {
+                                  if (a.time != b.time) return a.time < b.time;
+                                  return a.id < b.id;
+                                });
+    bucket.insert(pos, std::move(entry));
+    ++size_;
+    if (size_ > 2 * buckets_.size()) Resize(2 * buckets_.size());
+  }
+
+  /**
+   * @brief Returns the earliest entry without removing it.
+   *
+   * May advance the internal scan position to the entry's day; the
+   * reference is valid until the next Push() or PopMin().
+   *
+   * The queue must not be empty.
+   *
+   * @return Reference to the entry with the smallest (time, id)
+   */
+  const Entry& PeekMin() { return MinBucket().front(); }
+
+  /**
+   * @brief Removes and returns the earliest entry.
+   *
+   * The queue must not be empty.
+   *
+   * @return The entry with the smallest (time, id)
+   */
+  Entry PopMin() {
+    auto& bucket = MinBucket();
+    Entry entry = std::move(bucket.front());
+    bucket.erase(bucket.begin());
+    --size_;
+    last_time_ = entry.time;
+    if (size_ < buckets_.size() / 2 && buckets_.size() > kMinBuckets) {
+      Resize(buckets_.size() / 2);
+    }
+    return entry;
+  }
+
+ private:
+  static constexpr std::size_t kMinBuckets = 16;  ///< Smallest calendar
+
+  /**
+   * @brief Finds the bucket whose front entry is the queue-wide minimum.
+   *
+   * Scans forward from the current "day", wrapping around at year end;
+   * if a whole year passes without finding an event (a long gap), falls
+   * back to a direct search over all buckets and jumps the calendar
+   * there. The queue must not be empty.
+   */
+  std::vector<Entry>& MinBucket() {
+    while (true) {
+      auto& bucket = buckets_[current_bucket_];
+      if (!bucket.empty() && bucket.front().time < bucket_top_) {
+        scanned_ = 0;
+        return bucket;
+      }
+
+      // Advance to the next day, wrapping at year end
+      ++current_bucket_;
+      bucket_top_ += width_;
+      if (current_bucket_ == buckets_.size()) {
+        current_bucket_ = 0;
+      }
+      ++scanned_;
+      if (scanned_ > buckets_.size()) {
+        // Scanned a full year without a hit: jump directly to the
+        // earliest event instead of walking empty years
+        JumpToMin();
+      }
+    }
+  }
+
+  /**
+   * @brief Maps a timestamp to its bucket index.
+   */
+  std::size_t BucketIndex(double time) const {
+    return static_cast<std::size_t>(time / width_) % buckets_.size();
+  }
+
+  /**
+   * @brief Positions the scan at the day containing the given time.
+   */
+  void SetScanPosition(double time) {
+    std::size_t virtual_day = static_cast<std::size_t>(time / width_);
+    current_bucket_ = virtual_day % buckets_.size();
+    bucket_top_ = (static_cast<double>(virtual_day) + 1.0) * width_;
+    scanned_ = 0;
+  }
+
+  /**
+   * @brief Points the scan directly at the earliest stored event.
+   */
+  void JumpToMin() {
+    double min_time = std::numeric_limits<double>::infinity();
+    for (const auto& bucket : buckets_) {
+      if (!bucket.empty()) min_time = std::min(min_time, bucket.front().time);
+    }
+    SetScanPosition(min_time);
+  }
+
+  /**
+   * @brief Rebuilds the calendar with a new bucket count.
+   *
+   * The new bucket width is the current average spacing between event
+   * times (range divided by count), times a factor of 3 so that a day
+   * holds a few events on average, as recommended by Brown.
+   */
+  void Resize(std::size_t new_bucket_count) {
+    std::vector<Entry> entries;
+    entries.reserve(size_);
+    for (auto& bucket : buckets_) {
+      for (auto& entry : bucket) entries.push_back(std::move(entry));
+      bucket.clear();
+    }
+
+    double min_time = std::numeric_limits<double>::infinity();
+    double max_time = -std::numeric_limits<double>::infinity();
+    for (const auto& entry : entries) {
+      min_time = std::min(min_time, entry.time);
+      max_time = std::max(max_time, entry.time);
+    }
+    if (entries.size() > 1 && max_time > min_time) {
+      width_ = 3.0 * (max_time - min_time) /
+               static_cast<double>(entries.size());
+    }
+
+    // clear + resize rather than assign: assign would copy-construct the
+    // inner vectors, which move-only entry types cannot satisfy
+    buckets_.clear();
+    buckets_.resize(new_bucket_count);
+    size_ = 0;
+    for (auto& entry : entries) {
+      ++size_;
+      auto& bucket = buckets_[BucketIndex(entry.time)];
+      auto pos = std::upper_bound(bucket.begin(), bucket.end(), entry,
+                                  [](const Entry& a, const Entry& b) {
+                                    if (a.time != b.time)
+                                      return a.time < b.time;
+                                    return a.id < b.id;
+                                  });
+      bucket.insert(pos, std::move(entry));
+    }
+    SetScanPosition(size_ > 0 ? std::max(last_time_, min_time) : last_time_);
+  }
+
+  std::vector<std::vector<Entry>> buckets_;  ///< Day buckets, each sorted
+  std::size_t size_;                         ///< Total stored entries
+  double width_;                             ///< Bucket (day) width
+  double last_time_;                         ///< Time of last popped entry
+  std::size_t current_bucket_;               ///< Day the scan is on
+  double bucket_top_;                        ///< Upper time bound of that day
+  std::size_t scanned_;  ///< Days scanned since the last hit
+};
+
+}  // namespace desvu
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace desvu {
+
+/**
+ * @brief Mixin that recycles the heap storage of an event type.
+ *
+ * Deriving an event from PooledEvent<T> (alongside Event) overrides
+ * operator new/delete for that type with a per-type free list: deleting
+ * an event pushes its storage onto the list, and the next
+ * std::make_unique of the same type pops it back off instead of calling
+ * the global allocator. In steady state an event-driven simulation
+ * churns through many short-lived events of a few types, so after
+ * warm-up the hot loop allocates nothing at all. Ownership semantics
+ * are unchanged — the simulator still holds events by unique_ptr.
+ *
+ * @code
+ * class ArrivalEvent : public desvu::Event,
+ *                      public desvu::PooledEvent<ArrivalEvent> {
+ *   ...
+ * };
+ * @endcode
+ *
+ * The free list is thread_local, so replications running on different
+ * threads each recycle their own storage without synchronization.
+ * Recycled blocks are only returned to the system via ReleasePool() or
+ * at thread exit; for simulations of a few event types this is a few
+ * kilobytes at most.
+ */
+template <class T>
+class PooledEvent {
+ public:
+  static void* operator new(std::size_t size) {
+    // A class derived further from T may be larger; let those fall
+    // through to the global allocator
+    if (size != sizeof(T) || free_list_.blocks.empty()) {
+      return ::operator new(size);
+    }
+    void* block = free_list_.blocks.back();
+    free_list_.blocks.pop_back();
+    return block;
+  }
+
+  static void operator delete(void* block, std::size_t size) {
+    if (size != sizeof(T)) {
+      ::operator delete(block);
+      return;
+    }
+    free_list_.blocks.push_back(block);
+  }
+
+  /**
+   * @brief Returns all recycled blocks of this type to the system.
+   */
+  static void ReleasePool() {
+    for (void* block : free_list_.blocks) ::operator delete(block);
+    free_list_.blocks.clear();
+  }
+
+ private:
+  /// Free list wrapper: a bare vector's destructor would free only the
+  /// pointer array and leak every block it still holds at thread exit.
+  struct FreeList {
+    std::vector<void*> blocks;
+    ~FreeList() {
+      for (void* block : blocks) ::operator delete(block);
+    }
+  };
+
+  static thread_local inline FreeList free_list_;
+};
+
+}  // namespace desvu
@@ -1,11 +1,16 @@
 #pragma once
 
+#include <cassert>
 #include <cstddef>
-#include <iomanip>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <memory>
-#include <queue>
+#include <optional>
+#include <utility>
 
+#include "calendar_queue.h"
 #include "event.h"
 
 namespace desvu {
@@ -16,41 +21,91 @@ namespace desvu {
 namespace detail {
 
 /**
- * @brief Represents an event in the priority queue.
+ * @brief Maps a double to an unsigned key with the same ordering.
+ *
+ * IEEE 754 doubles of the same sign compare like their bit patterns;
+ * flipping the sign bit (and, for negatives, the remaining bits) makes
+ * a single unsigned comparison agree with the double comparison for all
+ * finite values. This lets event ordering be decided without a
+ * floating-point compare-and-branch.
+ *
+ * @param value The value to map (typically an event time)
+ * @return Unsigned key such that key(a) < key(b) iff a < b
+ */
+inline std::uint64_t OrderedKey(double value) {
+  std::uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const std::uint64_t sign_fill =
+      static_cast<std::uint64_t>(-static_cast<std::int64_t>(bits >> 63));
+  return bits ^ (sign_fill | 0x8000000000000000ULL);
+}
+
+/**
+ * @brief Represents an event in the event queue.
  *
  * Wraps an event with its scheduled time and unique ID for ordering.
+ * Packed to 24 bytes (time, 32-bit id plus padding, owning pointer) so
+ * the queue's bucket vectors fit more entries per cache line; the
+ * 32-bit id allows over 4 billion events per run before wrapping.
  */
 struct ScheduledEvent {
   double time;                   ///< Scheduled execution time
-  std::size_t id;                ///< Unique event identifier
-  std::shared_ptr<Event> event;  ///< The actual event
+  std::uint32_t id;              ///< Unique event identifier
+  std::unique_ptr<Event> event;  ///< The actual event (owned by the queue)
 
   /**
    * @brief Constructs a scheduled event.
    * @param t Execution time
    * @param i Unique identifier
-   * @param e Shared pointer to the event
+   * @param e Owning pointer to the event
    */
-  ScheduledEvent(double t, std::size_t i, std::shared_ptr<Event> e)
+  ScheduledEvent(double t, std::uint32_t i, std::unique_ptr<Event> e)
       : time(t), id(i), event(std::move(e)) {}
 
   /**
-   * @brief Comparison operator for priority queue ordering.
+   * @brief Comparison operator for event ordering.
+   *
+   * Orders by priority: earliest time first, with ties broken by ID
+   * (lower ID = scheduled earlier). a < b means a fires later than b.
    *
-   * Creates a min-heap with earliest time having highest priority.
-   * Ties are broken by ID (lower ID = scheduled earlier).
+   * Maps the times to order-preserving integer keys and combines the
+   * comparisons with bitwise operators so the whole decision is
+   * branchless; times rarely tie, which would make a tie-check branch
+   * hard to predict.
    *
    * @param other The other scheduled event to compare with
    * @return true if this event has lower priority than other
    */
   bool operator<(const ScheduledEvent& other) const {
-    // min-heap (earliest time has highest priority)
-    // Break ties by id (lower id = scheduled earlier = higher priority)
-    if (time != other.time) return time > other.time;
-    return id > other.id;
+    const std::uint64_t a = OrderedKey(time);
+    const std::uint64_t b = OrderedKey(other.time);
+    return (a > b) | ((a == b) & (id > other.id));
   }
 };
 
+static_assert(sizeof(ScheduledEvent) <= 24,
+              "ScheduledEvent should stay within 24 bytes");
+
+/**
+ * @brief Event that runs a callable, used by Simulator::Schedule(delay, f).
+ *
+ * The callable is stored inline by value (no std::function indirection),
+ * so the compiler sees its concrete type and can inline the body into
+ * Action().
+ */
+template <class F>
+class CallbackEvent : public Event {
+ public:
+  CallbackEvent(double delay, F action)
+      : Event(delay), action_(std::move(action)) {}
+
+  void Action(Simulator& sim) override { action_(sim); }
+  std::string ToString() const override { return "Callback"; }
+
+ private:
+  F action_;  ///< The scheduled callable
+};
+
 }  // namespace detail
 
 /**
@@ -63,8 +118,49 @@ class Simulator {
  private:
   double time;                ///< Current simulation time
   bool log_events;            ///< Whether to log events to console
-  std::size_t event_counter;  ///< Counter for unique event IDs
-  std::priority_queue<detail::ScheduledEvent> event_queue;  ///< Event queue
+  std::uint32_t event_counter;  ///< Counter for unique event IDs
+  CalendarQueue<detail::ScheduledEvent> event_queue;  ///< Event queue
+  std::unique_ptr<Event> current_;  ///< Event currently executing in Run()
+
+  /// One-slot cache holding the earliest pending event, kept outside the
+  /// calendar queue. In event-driven models most events are scheduled into
+  /// the near future (e.g. a departure right after its arrival), so the
+  /// next event to fire frequently passes through this slot without ever
+  /// touching a bucket. Invariant: when occupied, the slot precedes every
+  /// queued entry in (time, id) order.
+  std::optional<detail::ScheduledEvent> next_;
+
+  /**
+   * @brief Inserts a queue entry, maintaining the next-slot invariant.
+   */
+  void Enqueue(detail::ScheduledEvent entry) {
+    if (!next_) {
+      // operator< orders by priority, so "min < entry" means the new
+      // entry fires before everything currently queued
+      if (event_queue.Empty() || event_queue.PeekMin() < entry) {
+        next_.emplace(std::move(entry));
+        return;
+      }
+    } else if (*next_ < entry) {
+      // New entry fires before the cached one: demote the cache
+      event_queue.Push(std::move(*next_));
+      next_.emplace(std::move(entry));
+      return;
+    }
+    event_queue.Push(std::move(entry));
+  }
+
+  /**
+   * @brief Removes and returns the earliest pending entry.
+   */
+  detail::ScheduledEvent DequeueNext() {
+    if (next_) {
+      detail::ScheduledEvent entry = std::move(*next_);
+      next_.reset();
+      return entry;
+    }
+    return event_queue.PopMin();
+  }
 
  public:
   /**
@@ -78,18 +174,76 @@ class Simulator {
    * @brief Returns the current simulation time.
    * @return Current time
    */
-  double Now() const { return time; }
+  double Now() const noexcept { return time; }
+
+  /**
+   * @brief Pre-sizes the event queue for an expected number of events.
+   *
+   * Optional: models that know roughly how many events will be pending
+   * at once (not the total executed) can call this before Run() to skip
+   * the queue's initial growth steps.
+   *
+   * @param expected_events Expected simultaneous pending event count
+   */
+  void ReserveEvents(std::size_t expected_events) {
+    event_queue.Reserve(expected_events);
+  }
 
   /**
    * @brief Schedules an event for future execution.
    *
-   * The event will execute at time Now() + event->delay.
+   * The event will execute at time Now() + event->delay. The simulator
+   * takes ownership of the event; the returned raw pointer remains valid
+   * until the event has executed and can be used to Cancel() it.
+   *
+   * @param event Owning pointer to the event to schedule
+   * @return Non-owning pointer to the scheduled event
+   */
+  Event* Schedule(std::unique_ptr<Event> event) {
+    Event* handle = event.get();
+    handle->time = time + handle->delay;
+    Enqueue(detail::ScheduledEvent(handle->time, event_counter++,
+                                   std::move(event)));
+    return handle;
+  }
+
+  /**
+   * @brief Schedules a callable to run after a delay.
+   *
+   * Convenience overload for one-off actions that do not warrant a named
+   * Event subclass. The callable takes a Simulator& and is invoked at
+   * time Now() + delay; it may schedule further events.
+   *
+   * @param delay Time delay until the callable runs
+   * @param action Callable taking a Simulator&
+   * @return Non-owning pointer to the scheduled event (e.g. for Cancel())
+   */
+  template <class F>
+  Event* Schedule(double delay, F action) {
+    return Schedule(
+        std::make_unique<detail::CallbackEvent<F>>(delay, std::move(action)));
+  }
+
+  /**
+   * @brief Reschedules the currently executing event.
+   *
+   * May only be called from inside Event::Action(), with the event that is
+   * currently executing. The event is reinserted into the queue to execute
+   * again at time Now() + delay, without allocating a new event object.
+   * This is the natural way to express self-perpetuating event chains
+   * (e.g. a recurring arrival process).
    *
-   * @param event Shared pointer to the event to schedule
+   * @param event The currently executing event (i.e. `this` in Action())
+   * @param delay Time delay until the event executes again
    */
-  void Schedule(const std::shared_ptr<Event>& event) {
-    event->time = time + event->delay;
-    event_queue.emplace(event->time, event_counter++, event);
+  void Reschedule(Event* event, double delay) {
+    assert(event == current_.get() &&
+           "Reschedule() may only be used with the currently executing event");
+    event->delay = delay;
+    event->time = time + delay;
+    event->cancelled = false;
+    Enqueue(detail::ScheduledEvent(event->time, event_counter++,
+                                   std::move(current_)));
   }
 
   /**
@@ -101,24 +255,38 @@ class Simulator {
    * @param until Maximum simulation time (-1.0 for unlimited)
    */
   void Run(double until = -1.0) {
-    while (!event_queue.empty()) {
-      auto [event_time, id, event] = event_queue.top();
-      event_queue.pop();
+    while (next_ || !event_queue.Empty()) {
+      detail::ScheduledEvent entry = DequeueNext();
+      double event_time = entry.time;
+      current_ = std::move(entry.event);
 
       if (until >= 0.0 && event_time > until) {
+        current_.reset();
         time = until;
         return;
       }
 
-      if (event->cancelled) continue;
+      if (current_->cancelled) {
+        current_.reset();
+        continue;
+      }
 
       time = event_time;
 
-      if (log_events)
-        std::cout << "t=" << std::setw(6) << std::setprecision(1) << std::fixed
-                  << time << " | " << event->ToString() << "\n";
+      if (log_events) {
+        // snprintf rather than stream manipulators: setw/setprecision
+        // mutate (and must restore) stream state on every event, which
+        // makes the verbose path far slower than the formatting alone
+        char prefix[32];
+        std::snprintf(prefix, sizeof(prefix), "t=%6.1f | ", time);
+        std::cout << prefix << current_->ToString() << '\n';
+      }
 
+      // Action() may hand the event back to the queue via Reschedule(),
+      // in which case current_ is empty afterwards and reset() is a no-op.
+      Event* event = current_.get();
       event->Action(*this);
+      current_.reset();
     }
   }
 };
@@ -9,6 +9,11 @@
  * Core simulation components:
  *   - Event: Base class for simulation events
  *   - Simulator: Discrete event simulation engine
+ *   - StaticSimulator: Allocation-free engine for a fixed set of event types
+ *   - PooledEvent: Mixin that recycles event storage through a free list
+ *
+ * Random number generation:
+ *   - BatchedExponential: Fast block-based exponential variate generator
  *
  * Statistics collection:
  *   - EventStats: Statistics for event-based observations (e.g., waiting times)
@@ -30,7 +35,7 @@
  *
  * int main() {
  *   desvu::Simulator sim;
- *   sim.Schedule(std::make_shared<ArrivalEvent>(0.0));
+ *   sim.Schedule(std::make_unique<ArrivalEvent>(0.0));
  *   sim.Run(100.0);
  *   return 0;
  * }
@@ -40,8 +45,14 @@
 #pragma once
 
 // Core simulation
+#include "core/calendar_queue.h"
 #include "core/event.h"
+#include "core/event_pool.h"
 #include "core/simulator.h"
+#include "core/static_simulator.h"
+
+// Random number generation
+#include "random/batched_exponential.h"
 
 // Statistics
 #include "stats/event_stats.h"
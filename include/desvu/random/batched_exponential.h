@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace desvu {
+
+/**
+ * @brief Fast exponential random variate generator with block refills.
+ *
+ * Generates exponentially distributed variates via the inverse-CDF method
+ * (-log(1 - u) / rate) on top of the xoshiro256++ engine. Variates are
+ * produced in blocks of 1024 in a tight, branch-free loop that compilers
+ * can unroll and vectorize, so the per-sample cost on the simulation hot
+ * path is a single buffered load plus a rare refill.
+ *
+ * Compared to std::mt19937 + std::exponential_distribution this avoids a
+ * function call and engine state update per sample, while remaining fully
+ * portable (no intrinsics). The -1/rate multiplier is computed once at
+ * construction.
+ */
+class BatchedExponential {
+ public:
+  /**
+   * @brief Constructs a generator for the given rate.
+   * @param rate Rate parameter (lambda) of the exponential distribution
+   * @param seed Seed for the underlying xoshiro256++ engine
+   */
+  explicit BatchedExponential(double rate, std::uint64_t seed)
+      : inv_rate_(1.0 / rate), pos_(kBlockSize) {
+    // Expand the seed into the 256-bit engine state with splitmix64,
+    // the initialization recommended by the xoshiro authors.
+    std::uint64_t x = seed;
+    for (auto& word : state_) {
+      x += 0x9E3779B97F4A7C15ULL;
+      std::uint64_t z = x;
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      word = z ^ (z >> 31);
+    }
+  }
+
+  /**
+   * @brief Returns the next exponential variate.
+   * @return Exponentially distributed value with the configured rate
+   */
+  double Next() {
+    if (pos_ == kBlockSize) Refill();
+    return buffer_[pos_++];
+  }
+
+  /**
+   * @brief Gets the rate parameter of this generator.
+   * @return The rate (lambda)
+   */
+  double Rate() const { return 1.0 / inv_rate_; }
+
+ private:
+  static constexpr std::size_t kBlockSize = 1024;  ///< Variates per refill
+
+  /**
+   * @brief Refills the variate buffer with a block of exponentials.
+   */
+  void Refill() {
+    for (std::size_t i = 0; i < kBlockSize; ++i) {
+      // Map the top 53 bits to a uniform double in [0, 1), then invert
+      // the exponential CDF. log1p keeps precision for small u.
+      double u =
+          static_cast<double>(NextU64() >> 11) * 0x1.0p-53;
+      buffer_[i] = -std::log1p(-u) * inv_rate_;
+    }
+    pos_ = 0;
+  }
+
+  /**
+   * @brief Advances the xoshiro256++ engine and returns 64 random bits.
+   */
+  std::uint64_t NextU64() {
+    auto rotl = [](std::uint64_t v, int k) {
+      return (v << k) | (v >> (64 - k));
+    };
+    std::uint64_t result = rotl(state_[0] + state_[3], 23) + state_[0];
+    std::uint64_t t = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = rotl(state_[3], 45);
+    return result;
+  }
+
+  std::array<std::uint64_t, 4> state_;       ///< xoshiro256++ engine state
+  double inv_rate_;                          ///< Precomputed 1 / rate
+  std::array<double, kBlockSize> buffer_;    ///< Buffered variates
+  std::size_t pos_;                          ///< Next unread buffer slot
+};
+
+}  // namespace desvu
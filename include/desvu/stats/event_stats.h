@@ -1,15 +1,12 @@
 #pragma once
 
 #include <algorithm>
-#include <cassert>
+#include <array>
 #include <cmath>
-#include <iomanip>
-#include <numeric>
-#include <sstream>
+#include <cstdio>
 #include <string>
 #include <stdexcept>
 #include <utility>
-#include <vector>
 
 namespace desvu {
 
@@ -20,73 +17,142 @@ namespace desvu {
  * service times, or any value that is observed at specific points in time.
  * Note: "Event-based" refers to when observations are recorded (at events),
  * not the nature of the data (which can be continuous values).
+ *
+ * Observations are folded into running moments (Welford's online
+ * algorithm) as they arrive, so memory use is constant regardless of how
+ * many values are recorded and every summary statistic is available in
+ * O(1). Raw observations are not retained.
  */
 class EventStats {
  private:
+  // Hot fields first: Add() touches only these, and together they fit
+  // in a single cache line. The name is cold (reports only) and
+  // deliberately last so it does not share that line.
+  size_t count_ = 0;   ///< Number of observations
+  double mean_ = 0.0;  ///< Running mean
+  double m2_ = 0.0;    ///< Sum of squared deviations from the running mean
+  double min_ = 0.0;   ///< Smallest observation (0.0 while empty)
+  double max_ = 0.0;   ///< Largest observation (0.0 while empty)
   std::string name_;
-  std::vector<double> observations_;
 
  public:
   /**
    * @brief Constructs a new event-based statistics collector.
    * @param name Descriptive name for this statistic
    */
-  explicit EventStats(const std::string& name) : name_(name), observations_() {}
+  explicit EventStats(const std::string& name) : name_(name) {}
 
   /**
    * @brief Adds an observation.
+   *
+   * Updates the running mean and variance with Welford's recurrence and
+   * tracks min/max; nothing else is stored.
+   *
    * @param value The observed value
    */
-  void Add(double value) { observations_.push_back(value); }
+  void Add(double value) noexcept {
+    if (count_ == 0) {
+      min_ = value;
+      max_ = value;
+    } else {
+      min_ = std::min(min_, value);
+      max_ = std::max(max_, value);
+    }
+    ++count_;
+    double delta = value - mean_;
+    mean_ += delta / static_cast<double>(count_);
+    m2_ += delta * (value - mean_);
+  }
+
+  /**
+   * @brief Adds a contiguous batch of observations.
+   *
+   * Accumulates the batch's moments in a tight local loop — which the
+   * compiler is free to unroll and vectorize, since nothing escapes per
+   * iteration — and then merges them with Chan's formula, exactly as
+   * Combine() would. Equivalent to calling Add() per value, up to
+   * floating-point association.
+   *
+   * @param values Pointer to the first observation
+   * @param count Number of observations
+   */
+  void AddRange(const double* values, size_t count) {
+    if (count == 0) return;
+
+    double mean = 0.0;
+    double m2 = 0.0;
+    double min = values[0];
+    double max = values[0];
+    for (size_t i = 0; i < count; ++i) {
+      double value = values[i];
+      min = std::min(min, value);
+      max = std::max(max, value);
+      double delta = value - mean;
+      mean += delta / static_cast<double>(i + 1);
+      m2 += delta * (value - mean);
+    }
+    CombineMoments(count, mean, m2, min, max);
+  }
+
+  /**
+   * @brief Merges another statistic into this one.
+   *
+   * Combines the running moments with Chan's parallel formula, as if all
+   * observations of both statistics had been added to this one. Useful
+   * for aggregating results across independent replications.
+   *
+   * @param other The statistic to merge in (left unchanged)
+   */
+  void Combine(const EventStats& other) {
+    CombineMoments(other.count_, other.mean_, other.m2_, other.min_,
+                   other.max_);
+  }
 
   /**
    * @brief Gets the number of observations.
    * @return Number of observations collected
    */
-  size_t Count() const { return observations_.size(); }
+  size_t Count() const { return count_; }
 
   /**
    * @brief Computes the average of all observations.
    * @return Mean value, or 0.0 if no observations exist
    */
-  double Average() const {
-    if (observations_.empty()) return 0.0;
-    return std::accumulate(observations_.begin(), observations_.end(), 0.0) /
-           static_cast<double>(observations_.size());
-  }
+  double Average() const { return mean_; }
 
   /**
    * @brief Computes the sample standard deviation of all observations.
    * @return Standard deviation, or 0.0 if less than 2 observations exist
    */
   double StandardDeviation() const {
-    if (observations_.size() < 2) return 0.0;
-    double avg = Average();
-    double variance = 0.0;
-    for (double val : observations_) {
-      variance += (val - avg) * (val - avg);
-    }
-    double scale = static_cast<double>(observations_.size() - 1);
-    return std::sqrt(variance / scale);
+    if (count_ < 2) return 0.0;
+    return std::sqrt(m2_ / static_cast<double>(count_ - 1));
+  }
+
+  /**
+   * @brief Returns the mean and sample standard deviation together.
+   *
+   * Both values come from the same running moments, so fetching them as
+   * a pair costs no more than either alone; prefer this when a caller
+   * needs both.
+   *
+   * @return Pair of (mean, standard deviation)
+   */
+  std::pair<double, double> MeanAndStdDev() const {
+    return std::make_pair(Average(), StandardDeviation());
   }
 
   /**
    * @brief Finds the minimum observation.
    * @return Minimum value, or 0.0 if no observations exist
    */
-  double Min() const {
-    if (observations_.empty()) return 0.0;
-    return *std::min_element(observations_.begin(), observations_.end());
-  }
+  double Min() const { return min_; }
 
   /**
    * @brief Finds the maximum observation.
    * @return Maximum value, or 0.0 if no observations exist
    */
-  double Max() const {
-    if (observations_.empty()) return 0.0;
-    return *std::max_element(observations_.begin(), observations_.end());
-  }
+  double Max() const { return max_; }
 
   /**
    * @brief Gets the name of this statistic.
@@ -94,12 +160,6 @@ class EventStats {
    */
   const std::string& Name() const { return name_; }
 
-  /**
-   * @brief Gets the underlying observations vector.
-   * @return Const reference to the observations vector
-   */
-  const std::vector<double>& Observations() const { return observations_; }
-
   /**
    * @brief Computes 95% confidence interval for the mean.
    *
@@ -110,40 +170,30 @@ class EventStats {
    * @throws std::invalid_argument if count < 2
    */
   std::pair<double, double> ConfidenceInterval95() const {
-    if (observations_.size() < 2) {
+    if (count_ < 2) {
       throw std::invalid_argument(
           "Need at least 2 observations to compute confidence interval");
     }
 
-    double mean = Average();
-    double std_dev = StandardDeviation();
-    size_t n = observations_.size();
+    const auto [mean, std_dev] = MeanAndStdDev();
+    size_t n = count_;
 
     // Compute standard error
     double std_error = std_dev / std::sqrt(static_cast<double>(n));
 
-    double critical_value;
+    // Two-tailed 95% critical values: t-distribution for small samples
+    // (indexed by df - 1), normal approximation (z = 1.96) for n > 30.
+    // See https://en.wikipedia.org/wiki/Student%27s_t-distribution
+    static constexpr std::array<double, 29> kTValues = {
+        12.706, 4.303, 3.182, 2.776, 2.571,  // df = 1-5
+        2.447,  2.365, 2.306, 2.262, 2.228,  // df = 6-10
+        2.201,  2.179, 2.160, 2.145, 2.131,  // df = 11-15
+        2.120,  2.110, 2.101, 2.093, 2.086,  // df = 16-20
+        2.080,  2.074, 2.069, 2.064, 2.060,  // df = 21-25
+        2.056,  2.052, 2.048, 2.045          // df = 26-29
+    };
 
-    if (n > 30) {
-      // Use normal approximation for large samples
-      critical_value = 1.96;
-    } else {
-      // Use t-distribution critical values for small samples
-      // Approximate values for common sample sizes (95% CI, two-tailed)
-      static const double t_values[] = {
-          12.706, 4.303, 3.182, 2.776, 2.571,  // df = 1-5
-          2.447,  2.365, 2.306, 2.262, 2.228,  // df = 6-10
-          2.201,  2.179, 2.160, 2.145, 2.131,  // df = 11-15
-          2.120,  2.110, 2.101, 2.093, 2.086,  // df = 16-20
-          2.080,  2.074, 2.069, 2.064, 2.060,  // df = 21-25
-          2.056,  2.052, 2.048, 2.045          // df = 26-29
-      };  // See https://en.wikipedia.org/wiki/Student%27s_t-distribution
-
-      size_t df = n - 1;
-      // Assert df is in valid range for the table
-      assert(df > 0 && df <= 29);
-      critical_value = t_values[df - 1];
-    }
+    double critical_value = n > 30 ? 1.96 : kTValues[n - 2];
 
     // Compute margin of error
     double margin = critical_value * std_error;
@@ -152,25 +202,78 @@ class EventStats {
   }
 
   /**
-   * @brief Generates a formatted report of statistical summaries.
-   * @return String containing formatted statistics
+   * @brief Appends a formatted report to an existing string.
+   *
+   * Unlike Report(), this writes into a caller-provided buffer, so a
+   * single string (with its capacity) can be reused across many reports
+   * without reallocating.
+   *
+   * @param out The string to append to
    */
-  std::string Report() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(4);
-    oss << name_ << " (Event-based)\n";
-    oss << "  Count: " << Count() << "\n";
-    oss << "  Average: " << Average() << "\n";
-    oss << "  Std Dev: " << StandardDeviation() << "\n";
-    oss << "  Min: " << Min() << "\n";
-    oss << "  Max: " << Max();
+  void AppendReport(std::string& out) const {
+    char line[96];
+    out.append(name_).append(" (Event-based)\n");
+    std::snprintf(line, sizeof(line), "  Count: %zu\n", count_);
+    out.append(line);
+    std::snprintf(line, sizeof(line), "  Average: %.4f\n", Average());
+    out.append(line);
+    std::snprintf(line, sizeof(line), "  Std Dev: %.4f\n",
+                  StandardDeviation());
+    out.append(line);
+    std::snprintf(line, sizeof(line), "  Min: %.4f\n", Min());
+    out.append(line);
+    std::snprintf(line, sizeof(line), "  Max: %.4f", Max());
+    out.append(line);
     if (Count() >= 2) {
       const auto ci = ConfidenceInterval95();
-      oss << "\n  95% CI: [" << ci.first << ", " << ci.second << "]";
+      std::snprintf(line, sizeof(line), "\n  95%% CI: [%.4f, %.4f]", ci.first,
+                    ci.second);
+      out.append(line);
     } else {
-      oss << "\n  95% CI: N/A (need >= 2 observations)";
+      out.append("\n  95% CI: N/A (need >= 2 observations)");
+    }
+  }
+
+  /**
+   * @brief Generates a formatted report of statistical summaries.
+   * @return String containing formatted statistics
+   */
+  std::string Report() const {
+    std::string out;
+    out.reserve(256);
+    AppendReport(out);
+    return out;
+  }
+
+ private:
+  /**
+   * @brief Merges a set of precomputed moments into this statistic.
+   *
+   * Chan's parallel combination of two Welford accumulations.
+   */
+  void CombineMoments(size_t count, double mean, double m2, double min,
+                      double max) {
+    if (count == 0) return;
+    if (count_ == 0) {
+      count_ = count;
+      mean_ = mean;
+      m2_ = m2;
+      min_ = min;
+      max_ = max;
+      return;
     }
-    return oss.str();
+
+    size_t combined = count_ + count;
+    double delta = mean - mean_;
+    double n1 = static_cast<double>(count_);
+    double n2 = static_cast<double>(count);
+    double n = static_cast<double>(combined);
+
+    mean_ += delta * (n2 / n);
+    m2_ += m2 + delta * delta * (n1 * n2 / n);
+    min_ = std::min(min_, min);
+    max_ = std::max(max_, max);
+    count_ = combined;
   }
 };
 
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace desvu {
+
+/**
+ * @brief Internal implementation details (not part of public API).
+ */
+namespace detail {
+
+/**
+ * @brief FNV-1a 64-bit hash over a string.
+ *
+ * Simple, fast for the short names used as statistic keys, and usable
+ * on a string_view so lookups never allocate a temporary std::string.
+ *
+ * @param key The string to hash
+ * @return 64-bit hash value
+ */
+inline std::uint64_t Fnv1aHash(std::string_view key) {
+  std::uint64_t hash = 1469598103934665603ULL;
+  for (unsigned char c : key) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/**
+ * @brief Small open-addressed map from statistic name to statistic.
+ *
+ * Purpose-built replacement for std::unordered_map in StatsCollector:
+ * an open-addressed, linear-probe index (a flat array of {hash, index}
+ * slots at most half full) pointing into a vector of unique_ptr-owned
+ * values. A collector typically holds well under a dozen statistics, so
+ * the whole index fits in a cache line or two and a probe is a couple
+ * of comparisons with no pointer chasing through buckets.
+ *
+ * Values are stored in insertion order and their addresses are stable
+ * across growth (only the index rehashes, the unique_ptrs never move
+ * their targets), which is what makes the collector's cached-handle
+ * pattern safe.
+ *
+ * T must be constructible from std::string and expose Name().
+ */
+template <class T>
+class StatMap {
+ public:
+  StatMap() : slots_(kMinSlots) {
+    // A half-full kMinSlots index holds 8 values; reserving the value
+    // vector to match means a typical collector (a handful of named
+    // statistics) never reallocates either structure after construction.
+    values_.reserve(kMinSlots / 2);
+  }
+
+  /**
+   * @brief Returns the number of stored values.
+   * @return Value count
+   */
+  std::size_t Size() const { return values_.size(); }
+
+  /**
+   * @brief Looks up a value by name.
+   * @param name The name to look up
+   * @return Pointer to the value, or nullptr if not present
+   */
+  T* Find(std::string_view name) noexcept {
+    const Slot& slot = slots_[FindSlot(name, Fnv1aHash(name))];
+    return slot.index_plus_one == 0 ? nullptr
+                                    : values_[slot.index_plus_one - 1].get();
+  }
+
+  /// @copydoc Find
+  const T* Find(std::string_view name) const noexcept {
+    return const_cast<StatMap*>(this)->Find(name);
+  }
+
+  /**
+   * @brief Looks up a value by name, creating it if absent.
+   *
+   * The returned reference is stable for the lifetime of the map.
+   *
+   * @param name The name to look up
+   * @return Reference to the (possibly newly created) value
+   */
+  T& GetOrCreate(std::string_view name) {
+    return *values_[GetOrCreateIndex(name)];
+  }
+
+  /**
+   * @brief Like GetOrCreate, but returns the value's position.
+   *
+   * Positions count up from zero in insertion order and never change,
+   * so they can be kept as compact handles and resolved via At().
+   *
+   * @param name The name to look up
+   * @return Index of the (possibly newly created) value
+   */
+  std::uint32_t GetOrCreateIndex(std::string_view name) {
+    const std::uint64_t hash = Fnv1aHash(name);
+    std::size_t i = FindSlot(name, hash);
+    if (slots_[i].index_plus_one != 0) {
+      return slots_[i].index_plus_one - 1;
+    }
+
+    // Keep the index at most half full so probe chains stay short
+    if (2 * (values_.size() + 1) > slots_.size()) {
+      Grow();
+      i = FindSlot(name, hash);
+    }
+    values_.push_back(std::make_unique<T>(std::string(name)));
+    slots_[i].index_plus_one = static_cast<std::uint32_t>(values_.size());
+    slots_[i].hash = hash;
+    return slots_[i].index_plus_one - 1;
+  }
+
+  /**
+   * @brief Resolves a position returned by GetOrCreateIndex.
+   * @param index The value's position
+   * @return Reference to the value
+   */
+  T& At(std::size_t index) noexcept { return *values_[index]; }
+
+  /**
+   * @brief Gives read access to the values in insertion order.
+   * @return The owned values, oldest first
+   */
+  const std::vector<std::unique_ptr<T>>& Values() const { return values_; }
+
+ private:
+  /// Index slot: 0 marks empty, otherwise value index + 1
+  struct Slot {
+    std::uint32_t index_plus_one = 0;  ///< Position in values_, shifted by 1
+    std::uint64_t hash = 0;            ///< Cached hash of the value's name
+  };
+
+  static constexpr std::size_t kMinSlots = 16;  ///< Smallest index size
+
+  /**
+   * @brief Probes for the slot holding the name, or the empty slot
+   *        where it would be inserted.
+   */
+  std::size_t FindSlot(std::string_view name, std::uint64_t hash) const {
+    const std::size_t mask = slots_.size() - 1;
+    std::size_t i = hash & mask;
+    while (true) {
+      const Slot& slot = slots_[i];
+      if (slot.index_plus_one == 0) return i;
+      if (slot.hash == hash &&
+          values_[slot.index_plus_one - 1]->Name() == name) {
+        return i;
+      }
+      i = (i + 1) & mask;
+    }
+  }
+
+  /**
+   * @brief Doubles the index and reinserts all slots by cached hash.
+   */
+  void Grow() {
+    std::vector<Slot> old_slots(slots_.size() * 2);
+    old_slots.swap(slots_);
+    const std::size_t mask = slots_.size() - 1;
+    for (const Slot& slot : old_slots) {
+      if (slot.index_plus_one == 0) continue;
+      std::size_t i = slot.hash & mask;
+      while (slots_[i].index_plus_one != 0) i = (i + 1) & mask;
+      slots_[i] = slot;
+    }
+  }
+
+  std::vector<Slot> slots_;                   ///< Open-addressed index
+  std::vector<std::unique_ptr<T>> values_;    ///< Values in insertion order
+};
+
+}  // namespace detail
+}  // namespace desvu
@@ -1,16 +1,31 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <sstream>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 #include <vector>
 
 #include "event_stats.h"
+#include "stat_map.h"
 #include "time_weighted_stats.h"
 
 namespace desvu {
 
+/**
+ * @brief Compact handle to a statistic registered with StatsCollector.
+ *
+ * Obtained once from RegisterEvent() or RegisterTimeWeighted() and then
+ * passed to the matching Add() overload, which indexes straight into
+ * the collector's storage with no hashing or string comparison. A
+ * handle is only meaningful for the collector and statistic kind it was
+ * registered with.
+ */
+struct StatId {
+  std::uint32_t index;  ///< Position in the collector's storage
+};
+
 /**
  * @brief Container for managing multiple statistics collectors.
  *
@@ -20,9 +35,16 @@ namespace desvu {
  */
 class StatsCollector {
  private:
-  std::unordered_map<std::string, std::unique_ptr<EventStats>> event_stats_;
-  std::unordered_map<std::string, std::unique_ptr<TimeWeightedStats>>
-      time_weighted_stats_;
+  detail::StatMap<EventStats> event_stats_;
+  detail::StatMap<TimeWeightedStats> time_weighted_stats_;
+
+  // One-slot most-recently-used caches for the string-keyed Add()
+  // overloads. Consecutive observations overwhelmingly target the same
+  // statistic, so on the repeat path a single name comparison replaces
+  // the hash-and-probe. Pointers stay valid because the maps guarantee
+  // stable value addresses.
+  EventStats* last_event_ = nullptr;              ///< Last event stat added to
+  TimeWeightedStats* last_time_weighted_ = nullptr;  ///< Last TW stat updated
 
  public:
   /**
@@ -38,12 +60,31 @@ class StatsCollector {
    * @param name The name of the statistic
    * @param value The observed value
    */
-  void Add(const std::string& name, double value) {
-    auto it = event_stats_.find(name);
-    if (it == event_stats_.end()) {
-      event_stats_[name] = std::make_unique<EventStats>(name);
+  void Add(std::string_view name, double value) {
+    if (last_event_ == nullptr || last_event_->Name() != name) {
+      last_event_ = &GetOrCreateEvent(name);
+    }
+    last_event_->Add(value);
+  }
+
+  /**
+   * @brief Adds a contiguous batch of event-based observations.
+   *
+   * One name lookup covers the whole batch, and the values are folded
+   * in with EventStats::AddRange, whose tight local loop the compiler
+   * can vectorize. Prefer this over per-value Add() when samples for
+   * one statistic are already buffered.
+   *
+   * @param name The name of the statistic
+   * @param values Pointer to the first observation
+   * @param count Number of observations
+   */
+  void AddRange(std::string_view name, const double* values,
+                std::size_t count) {
+    if (last_event_ == nullptr || last_event_->Name() != name) {
+      last_event_ = &GetOrCreateEvent(name);
     }
-    event_stats_[name]->Add(value);
+    last_event_->AddRange(values, count);
   }
 
   /**
@@ -55,12 +96,85 @@ class StatsCollector {
    * @param time The current simulation time
    * @param value The new value
    */
-  void Add(const std::string& name, double time, double value) {
-    auto it = time_weighted_stats_.find(name);
-    if (it == time_weighted_stats_.end()) {
-      time_weighted_stats_[name] = std::make_unique<TimeWeightedStats>(name);
+  void Add(std::string_view name, double time, double value) {
+    if (last_time_weighted_ == nullptr ||
+        last_time_weighted_->Name() != name) {
+      last_time_weighted_ = &GetOrCreateTimeWeighted(name);
     }
-    time_weighted_stats_[name]->Update(time, value);
+    last_time_weighted_->Update(time, value);
+  }
+
+  /**
+   * @brief Registers an event-based statistic and returns its handle.
+   *
+   * Creates the statistic if it doesn't exist. Call once at setup; the
+   * handle stays valid for the lifetime of the collector.
+   *
+   * @param name The name of the statistic
+   * @return Handle for the Add(StatId, double) fast path
+   */
+  StatId RegisterEvent(std::string_view name) {
+    return StatId{event_stats_.GetOrCreateIndex(name)};
+  }
+
+  /**
+   * @brief Registers a time-weighted statistic and returns its handle.
+   *
+   * Creates the statistic if it doesn't exist. Call once at setup; the
+   * handle stays valid for the lifetime of the collector.
+   *
+   * @param name The name of the statistic
+   * @return Handle for the Add(StatId, double, double) fast path
+   */
+  StatId RegisterTimeWeighted(std::string_view name) {
+    return StatId{time_weighted_stats_.GetOrCreateIndex(name)};
+  }
+
+  /**
+   * @brief Adds an event-based observation through a handle.
+   * @param id Handle from RegisterEvent()
+   * @param value The observed value
+   */
+  void Add(StatId id, double value) noexcept {
+    event_stats_.At(id.index).Add(value);
+  }
+
+  /**
+   * @brief Adds a time-weighted observation through a handle.
+   * @param id Handle from RegisterTimeWeighted()
+   * @param time The current simulation time
+   * @param value The new value
+   */
+  void Add(StatId id, double time, double value) {
+    time_weighted_stats_.At(id.index).Update(time, value);
+  }
+
+  /**
+   * @brief Gets or creates an event-based statistic by name.
+   *
+   * The returned reference is stable for the lifetime of the collector.
+   * Components that record to the same statistic on every event should
+   * call this once at setup and keep the reference (or a pointer),
+   * bypassing the name lookup on the hot path entirely.
+   *
+   * @param name The name of the statistic
+   * @return Reference to the (possibly newly created) EventStats
+   */
+  EventStats& GetOrCreateEvent(std::string_view name) {
+    return event_stats_.GetOrCreate(name);
+  }
+
+  /**
+   * @brief Gets or creates a time-weighted statistic by name.
+   *
+   * The returned reference is stable for the lifetime of the collector;
+   * see GetOrCreateEvent() for the intended caching pattern.
+   *
+   * @param name The name of the statistic
+   * @return Reference to the (possibly newly created) TimeWeightedStats
+   */
+  TimeWeightedStats& GetOrCreateTimeWeighted(std::string_view name) {
+    return time_weighted_stats_.GetOrCreate(name);
   }
 
   /**
@@ -68,12 +182,8 @@ class StatsCollector {
    * @param name The name of the statistic
    * @return Pointer to the EventStats, or nullptr if not found
    */
-  const EventStats* GetEvent(const std::string& name) const {
-    auto it = event_stats_.find(name);
-    if (it != event_stats_.end()) {
-      return it->second.get();
-    }
-    return nullptr;
+  const EventStats* GetEvent(std::string_view name) const noexcept {
+    return event_stats_.Find(name);
   }
 
 
@@ -82,12 +192,9 @@ class StatsCollector {
    * @param name The name of the statistic
    * @return Pointer to the TimeWeightedStats, or nullptr if not found
    */
-  const TimeWeightedStats* GetTimeWeighted(const std::string& name) const {
-    auto it = time_weighted_stats_.find(name);
-    if (it != time_weighted_stats_.end()) {
-      return it->second.get();
-    }
-    return nullptr;
+  const TimeWeightedStats* GetTimeWeighted(std::string_view name) const
+      noexcept {
+    return time_weighted_stats_.Find(name);
   }
 
   /**
@@ -95,8 +202,8 @@ class StatsCollector {
    * @param name The name to check
    * @return true if the statistic exists
    */
-  bool HasEvent(const std::string& name) const {
-    return event_stats_.find(name) != event_stats_.end();
+  bool HasEvent(std::string_view name) const noexcept {
+    return event_stats_.Find(name) != nullptr;
   }
 
   /**
@@ -104,8 +211,39 @@ class StatsCollector {
    * @param name The name to check
    * @return true if the statistic exists
    */
-  bool HasTimeWeighted(const std::string& name) const {
-    return time_weighted_stats_.find(name) != time_weighted_stats_.end();
+  bool HasTimeWeighted(std::string_view name) const noexcept {
+    return time_weighted_stats_.Find(name) != nullptr;
+  }
+
+  /**
+   * @brief Visits each event-based statistic name without copying.
+   *
+   * The callback receives a string_view into the statistic's stored
+   * name, valid for the lifetime of the collector. Names are visited in
+   * insertion order. Prefer this over EventNames() when the caller only
+   * iterates.
+   *
+   * @param visit Callable taking a std::string_view
+   */
+  template <class F>
+  void ForEachEventName(F&& visit) const {
+    for (const auto& stat : event_stats_.Values()) {
+      visit(std::string_view(stat->Name()));
+    }
+  }
+
+  /**
+   * @brief Visits each time-weighted statistic name without copying.
+   *
+   * See ForEachEventName() for the callback contract.
+   *
+   * @param visit Callable taking a std::string_view
+   */
+  template <class F>
+  void ForEachTimeWeightedName(F&& visit) const {
+    for (const auto& stat : time_weighted_stats_.Values()) {
+      visit(std::string_view(stat->Name()));
+    }
   }
 
   /**
@@ -114,10 +252,10 @@ class StatsCollector {
    */
   std::vector<std::string> EventNames() const {
     std::vector<std::string> names;
-    names.reserve(event_stats_.size());
-    for (const auto& pair : event_stats_) {
-      names.push_back(pair.first);
-    }
+    names.reserve(event_stats_.Size());
+    ForEachEventName([&names](std::string_view name) {
+      names.emplace_back(name);
+    });
     return names;
   }
 
@@ -127,10 +265,10 @@ class StatsCollector {
    */
   std::vector<std::string> TimeWeightedNames() const {
     std::vector<std::string> names;
-    names.reserve(time_weighted_stats_.size());
-    for (const auto& pair : time_weighted_stats_) {
-      names.push_back(pair.first);
-    }
+    names.reserve(time_weighted_stats_.Size());
+    ForEachTimeWeightedName([&names](std::string_view name) {
+      names.emplace_back(name);
+    });
     return names;
   }
 
@@ -140,23 +278,25 @@ class StatsCollector {
    * @return Formatted string with all statistics
    */
   std::string Report(double end_time) const {
-    std::ostringstream oss;
-    oss << "=== Statistics Report ===\n";
+    std::string out;
+    out.reserve(
+        32 + 256 * (event_stats_.Size() + time_weighted_stats_.Size()));
+    out += "=== Statistics Report ===\n";
 
     bool first = true;
-    for (const auto& pair : event_stats_) {
-      if (!first) oss << "\n\n";
-      oss << pair.second->Report();
+    for (const auto& stat : event_stats_.Values()) {
+      if (!first) out += "\n\n";
+      stat->AppendReport(out);
       first = false;
     }
 
-    for (const auto& pair : time_weighted_stats_) {
-      if (!first) oss << "\n\n";
-      oss << pair.second->Report(end_time);
+    for (const auto& stat : time_weighted_stats_.Values()) {
+      if (!first) out += "\n\n";
+      stat->AppendReport(end_time, out);
       first = false;
     }
 
-    return oss.str();
+    return out;
   }
 };
 
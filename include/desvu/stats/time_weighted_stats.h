@@ -1,8 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <cmath>
-#include <iomanip>
-#include <sstream>
+#include <cstdio>
+#include <stdexcept>
 #include <string>
 
 namespace desvu {
@@ -16,13 +17,17 @@ namespace desvu {
  */
 class TimeWeightedStats {
  private:
-  std::string name_;
+  // Hot fields first: Update() touches only these, and together they
+  // fit in a single cache line. The name is cold (reports only) and
+  // deliberately last so it does not share that line.
   double last_time_;
   double last_value_;
   double integral_;
+  double integral_comp_;  ///< Kahan compensation term for integral_
   double min_;
   double max_;
   size_t update_count_;
+  std::string name_;
 
  public:
   /**
@@ -34,13 +39,14 @@ class TimeWeightedStats {
    * @param name Descriptive name for this statistic
    */
   explicit TimeWeightedStats(const std::string& name)
-      : name_(name),
-        last_time_(0.0),
+      : last_time_(0.0),
         last_value_(0.0),
         integral_(0.0),
+        integral_comp_(0.0),
         min_(0.0),
         max_(0.0),
-        update_count_(1) {}
+        update_count_(1),
+        name_(name) {}
 
   /**
    * @brief Updates the statistic with a new value at the given time.
@@ -56,7 +62,15 @@ class TimeWeightedStats {
     }
 
     double duration = time - last_time_;
-    integral_ += last_value_ * duration;
+
+    // Kahan compensated summation: a plain += loses the low-order bits
+    // of small increments once the integral has grown large, which
+    // skews the average on long runs. The compensation term carries
+    // those bits to the next update.
+    double increment = last_value_ * duration - integral_comp_;
+    double summed = integral_ + increment;
+    integral_comp_ = (summed - integral_) - increment;
+    integral_ = summed;
 
     min_ = std::min(min_, value);
     max_ = std::max(max_, value);
@@ -126,20 +140,39 @@ class TimeWeightedStats {
    */
   double LastTime() const { return last_time_; }
 
+  /**
+   * @brief Appends a formatted report to an existing string.
+   *
+   * Unlike Report(), this writes into a caller-provided buffer, so a
+   * single string (with its capacity) can be reused across many reports
+   * without reallocating.
+   *
+   * @param end_time The end time of the simulation
+   * @param out The string to append to
+   */
+  void AppendReport(double end_time, std::string& out) const {
+    char line[96];
+    out.append(name_).append(" (Time-Weighted)\n");
+    std::snprintf(line, sizeof(line), "  Updates: %zu\n", update_count_);
+    out.append(line);
+    std::snprintf(line, sizeof(line), "  Average: %.4f\n", Average(end_time));
+    out.append(line);
+    std::snprintf(line, sizeof(line), "  Min: %.4f\n", Min());
+    out.append(line);
+    std::snprintf(line, sizeof(line), "  Max: %.4f", Max());
+    out.append(line);
+  }
+
   /**
    * @brief Generates a formatted report of statistical summaries.
    * @param end_time The end time of the simulation
    * @return String containing formatted statistics
    */
   std::string Report(double end_time) const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(4);
-    oss << name_ << " (Time-Weighted)\n";
-    oss << "  Updates: " << Count() << "\n";
-    oss << "  Average: " << Average(end_time) << "\n";
-    oss << "  Min: " << Min() << "\n";
-    oss << "  Max: " << Max();
-    return oss.str();
+    std::string out;
+    out.reserve(128);
+    AppendReport(end_time, out);
+    return out;
   }
 };
 
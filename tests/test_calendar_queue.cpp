@@ -0,0 +1,157 @@
+/**
+ * @file test_calendar_queue.cpp
+ * @brief Unit tests for the CalendarQueue class
+ */
+
+#include <desvu/desvu.h>
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+using namespace desvu;
+
+namespace {
+
+// Minimal entry type: a timestamp plus an insertion-order tie-breaker
+struct Entry {
+  double time;
+  std::size_t id;
+};
+
+}  // namespace
+
+// Test empty queue state
+TEST_CASE("CalendarQueue empty", "[calendar_queue]") {
+  CalendarQueue<Entry> queue;
+  REQUIRE(queue.Empty());
+  REQUIRE(queue.Size() == 0);
+}
+
+// Test entries come out in time order regardless of insertion order
+TEST_CASE("CalendarQueue time order", "[calendar_queue]") {
+  CalendarQueue<Entry> queue;
+  queue.Push(Entry{10.0, 0});
+  queue.Push(Entry{5.0, 1});
+  queue.Push(Entry{15.0, 2});
+
+  REQUIRE(queue.Size() == 3);
+  REQUIRE(queue.PopMin().time == 5.0);
+  REQUIRE(queue.PopMin().time == 10.0);
+  REQUIRE(queue.PopMin().time == 15.0);
+  REQUIRE(queue.Empty());
+}
+
+// Test ties are broken by id (insertion order)
+TEST_CASE("CalendarQueue tie-break by id", "[calendar_queue]") {
+  CalendarQueue<Entry> queue;
+  queue.Push(Entry{5.0, 3});
+  queue.Push(Entry{5.0, 1});
+  queue.Push(Entry{5.0, 2});
+
+  REQUIRE(queue.PopMin().id == 1);
+  REQUIRE(queue.PopMin().id == 2);
+  REQUIRE(queue.PopMin().id == 3);
+}
+
+// Test reserving capacity up front does not disturb ordering
+TEST_CASE("CalendarQueue reserve", "[calendar_queue]") {
+  CalendarQueue<Entry> queue;
+  queue.Reserve(1000);
+
+  for (std::size_t i = 0; i < 100; ++i) {
+    queue.Push(Entry{static_cast<double>(100 - i), i});
+  }
+  double last = 0.0;
+  while (!queue.Empty()) {
+    Entry e = queue.PopMin();
+    REQUIRE(e.time > last);
+    last = e.time;
+  }
+}
+
+// Test PeekMin exposes the earliest entry without removing it
+TEST_CASE("CalendarQueue peek", "[calendar_queue]") {
+  CalendarQueue<Entry> queue;
+  queue.Push(Entry{10.0, 0});
+  queue.Push(Entry{5.0, 1});
+
+  REQUIRE(queue.PeekMin().time == 5.0);
+  REQUIRE(queue.Size() == 2);
+  REQUIRE(queue.PopMin().time == 5.0);
+  REQUIRE(queue.PeekMin().time == 10.0);
+}
+
+// Test a large random workload pops in fully sorted order (forces resizes)
+TEST_CASE("CalendarQueue random workload", "[calendar_queue]") {
+  CalendarQueue<Entry> queue;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(0.0, 1000.0);
+
+  std::vector<double> times;
+  for (std::size_t i = 0; i < 2000; ++i) {
+    double t = dist(rng);
+    times.push_back(t);
+    queue.Push(Entry{t, i});
+  }
+  std::sort(times.begin(), times.end());
+
+  for (std::size_t i = 0; i < times.size(); ++i) {
+    REQUIRE(queue.PopMin().time == times[i]);
+  }
+  REQUIRE(queue.Empty());
+}
+
+// Test the hold model: interleaved push/pop with advancing times,
+// the access pattern of an event-driven simulation
+TEST_CASE("CalendarQueue hold model", "[calendar_queue]") {
+  CalendarQueue<Entry> queue;
+  std::mt19937 rng(7);
+  std::exponential_distribution<double> gap(1.0);
+
+  // Seed with a few events
+  std::size_t id = 0;
+  for (int i = 0; i < 8; ++i) {
+    queue.Push(Entry{gap(rng), id++});
+  }
+
+  // Pop the earliest, schedule a successor a small delay later
+  double last = 0.0;
+  for (int i = 0; i < 5000; ++i) {
+    Entry e = queue.PopMin();
+    REQUIRE(e.time >= last);
+    last = e.time;
+    queue.Push(Entry{e.time + gap(rng), id++});
+  }
+  REQUIRE(queue.Size() == 8);
+}
+
+// Test a long empty gap between event times (year-skipping path)
+TEST_CASE("CalendarQueue sparse times", "[calendar_queue]") {
+  CalendarQueue<Entry> queue;
+  queue.Push(Entry{0.5, 0});
+  queue.Push(Entry{10000.0, 1});
+  queue.Push(Entry{50000.0, 2});
+
+  REQUIRE(queue.PopMin().time == 0.5);
+  REQUIRE(queue.PopMin().time == 10000.0);
+  REQUIRE(queue.PopMin().time == 50000.0);
+}
+
+// Regression: pushing below the peeked minimum must rewind the scan
+TEST_CASE("CalendarQueue push below peeked min", "[calendar_queue]") {
+  CalendarQueue<Entry> queue;
+  queue.Push(Entry{100.0, 0});
+
+  // Peeking advances the internal scan to day 100
+  REQUIRE(queue.PeekMin().time == 100.0);
+
+  // A later push may still land on an earlier day: only popped times
+  // bound future pushes, not peeked ones
+  queue.Push(Entry{2.0, 1});
+
+  REQUIRE(queue.PopMin().time == 2.0);
+  REQUIRE(queue.PopMin().time == 100.0);
+  REQUIRE(queue.Empty());
+}
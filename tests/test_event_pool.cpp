@@ -0,0 +1,54 @@
+/**
+ * @file test_event_pool.cpp
+ * @brief Unit tests for the PooledEvent mixin
+ */
+
+#include <desvu/desvu.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+using namespace desvu;
+
+namespace {
+
+// Simple pooled event that counts how often it executes
+class PooledTestEvent : public Event, public PooledEvent<PooledTestEvent> {
+ public:
+  explicit PooledTestEvent(double delay, int* counter)
+      : Event(delay), counter_(counter) {}
+
+  void Action(Simulator& sim) override { ++(*counter_); }
+
+ private:
+  int* counter_;
+};
+
+}  // namespace
+
+// Test that recycled storage is reused for the next allocation
+TEST_CASE("PooledEvent recycles storage", "[event_pool]") {
+  int counter = 0;
+  auto first = std::make_unique<PooledTestEvent>(1.0, &counter);
+  void* first_address = first.get();
+  first.reset();  // returns the block to the pool
+
+  auto second = std::make_unique<PooledTestEvent>(2.0, &counter);
+  REQUIRE(static_cast<void*>(second.get()) == first_address);
+
+  second.reset();
+  PooledEvent<PooledTestEvent>::ReleasePool();
+}
+
+// Test that pooled events behave like normal events in a simulation
+TEST_CASE("PooledEvent works with Simulator", "[event_pool]") {
+  Simulator sim;
+  int counter = 0;
+  sim.Schedule(std::make_unique<PooledTestEvent>(1.0, &counter));
+  sim.Schedule(std::make_unique<PooledTestEvent>(2.0, &counter));
+  sim.Run();
+
+  REQUIRE(counter == 2);
+  REQUIRE(sim.Now() == 2.0);
+  PooledEvent<PooledTestEvent>::ReleasePool();
+}
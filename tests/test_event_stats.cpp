@@ -98,18 +98,56 @@ TEST_CASE("EventStats large dataset", "[event_stats]") {
   REQUIRE(stats.Max() == 1000.0);
 }
 
-// Test observations vector access
-TEST_CASE("EventStats observations access", "[event_stats]") {
+// Test fetching mean and standard deviation as a pair
+TEST_CASE("EventStats mean and stddev pair", "[event_stats]") {
+  EventStats stats("Test");
+  stats.Add(-5.0);
+  stats.Add(-3.0);
+  stats.Add(-1.0);
+
+  const auto [mean, std_dev] = stats.MeanAndStdDev();
+  REQUIRE(mean == -3.0);
+  REQUIRE(std_dev == 2.0);
+}
+
+// Test merging two statistics
+TEST_CASE("EventStats combine", "[event_stats]") {
+  EventStats part1("Test");
+  part1.Add(1.0);
+  part1.Add(2.0);
+  part1.Add(3.0);
+
+  EventStats part2("Test");
+  part2.Add(4.0);
+  part2.Add(5.0);
+
+  part1.Combine(part2);
+
+  // Same moments as adding all five values to one statistic
+  REQUIRE(part1.Count() == 5);
+  REQUIRE(part1.Average() == 3.0);
+  REQUIRE(part1.Min() == 1.0);
+  REQUIRE(part1.Max() == 5.0);
+  REQUIRE_THAT(part1.StandardDeviation(),
+               Catch::Matchers::WithinAbs(1.581, 0.001));
+}
+
+// Test combining with an empty statistic
+TEST_CASE("EventStats combine empty", "[event_stats]") {
   EventStats stats("Test");
-  stats.Add(1.0);
   stats.Add(2.0);
-  stats.Add(3.0);
+  stats.Add(4.0);
 
-  const auto& obs = stats.Observations();
-  REQUIRE(obs.size() == 3);
-  REQUIRE(obs[0] == 1.0);
-  REQUIRE(obs[1] == 2.0);
-  REQUIRE(obs[2] == 3.0);
+  EventStats empty("Test");
+  stats.Combine(empty);
+  REQUIRE(stats.Count() == 2);
+  REQUIRE(stats.Average() == 3.0);
+
+  empty.Combine(stats);
+  REQUIRE(empty.Count() == 2);
+  REQUIRE(empty.Average() == 3.0);
+  REQUIRE(empty.Min() == 2.0);
+  REQUIRE(empty.Max() == 4.0);
 }
 
 // Test report generation
@@ -232,3 +270,28 @@ TEST_CASE("EventStats confidence interval boundary n=30 vs n=31",
   REQUIRE_THAT(ci_31.first, Catch::Matchers::WithinAbs(32.399, 0.001));
   REQUIRE_THAT(ci_31.second, Catch::Matchers::WithinAbs(67.601, 0.001));
 }
+
+// Test batch insertion matches per-value insertion
+TEST_CASE("EventStats add range", "[event_stats]") {
+  EventStats batched("Test");
+  EventStats single("Test");
+
+  const double values[] = {1.0, 2.0, 3.0, 4.0, 5.0};
+  batched.AddRange(values, 5);
+  for (double v : values) single.Add(v);
+
+  REQUIRE(batched.Count() == 5);
+  REQUIRE(batched.Average() == single.Average());
+  REQUIRE(batched.StandardDeviation() == single.StandardDeviation());
+  REQUIRE(batched.Min() == 1.0);
+  REQUIRE(batched.Max() == 5.0);
+
+  // Merging a batch into existing observations behaves like Combine
+  single.AddRange(values, 5);
+  REQUIRE(single.Count() == 10);
+  REQUIRE(single.Average() == 3.0);
+
+  // Empty ranges are a no-op
+  batched.AddRange(values, 0);
+  REQUIRE(batched.Count() == 5);
+}
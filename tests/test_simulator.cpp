@@ -34,11 +34,26 @@ class ChainEvent : public Event {
   void Action(Simulator& sim) override {
     (*counter)++;
     if (*counter < max_count) {
-      sim.Schedule(std::make_shared<ChainEvent>(1.0, counter, max_count));
+      sim.Schedule(std::make_unique<ChainEvent>(1.0, counter, max_count));
     }
   }
 };
 
+// Event that reschedules itself a fixed number of times
+class RepeatingEvent : public Event {
+ public:
+  int* counter;
+  int max_count;
+
+  RepeatingEvent(double delay, int* cnt, int max)
+      : Event(delay), counter(cnt), max_count(max) {}
+
+  void Action(Simulator& sim) override {
+    (*counter)++;
+    if (*counter < max_count) sim.Reschedule(this, 2.0);
+  }
+};
+
 // Test basic simulator creation and time
 TEST_CASE("Simulator initial time", "[simulator]") {
   Simulator sim;
@@ -50,7 +65,7 @@ TEST_CASE("Simulator single event", "[simulator]") {
   Simulator sim;
   double exec_time = -1.0;
 
-  sim.Schedule(std::make_shared<TestEvent>(5.0, &exec_time));
+  sim.Schedule(std::make_unique<TestEvent>(5.0, &exec_time));
   sim.Run();
 
   REQUIRE(exec_time == 5.0);
@@ -62,9 +77,9 @@ TEST_CASE("Simulator event order", "[simulator]") {
   Simulator sim;
   double exec_time1 = -1.0, exec_time2 = -1.0, exec_time3 = -1.0;
 
-  sim.Schedule(std::make_shared<TestEvent>(10.0, &exec_time1));
-  sim.Schedule(std::make_shared<TestEvent>(5.0, &exec_time2));
-  sim.Schedule(std::make_shared<TestEvent>(15.0, &exec_time3));
+  sim.Schedule(std::make_unique<TestEvent>(10.0, &exec_time1));
+  sim.Schedule(std::make_unique<TestEvent>(5.0, &exec_time2));
+  sim.Schedule(std::make_unique<TestEvent>(15.0, &exec_time3));
 
   sim.Run();
 
@@ -79,8 +94,8 @@ TEST_CASE("Simulator simultaneous events", "[simulator]") {
   Simulator sim;
   double exec_time1 = -1.0, exec_time2 = -1.0;
 
-  sim.Schedule(std::make_shared<TestEvent>(5.0, &exec_time1));
-  sim.Schedule(std::make_shared<TestEvent>(5.0, &exec_time2));
+  sim.Schedule(std::make_unique<TestEvent>(5.0, &exec_time1));
+  sim.Schedule(std::make_unique<TestEvent>(5.0, &exec_time2));
 
   sim.Run();
 
@@ -93,8 +108,8 @@ TEST_CASE("Simulator run with time limit", "[simulator]") {
   Simulator sim;
   double exec_time1 = -1.0, exec_time2 = -1.0;
 
-  sim.Schedule(std::make_shared<TestEvent>(5.0, &exec_time1));
-  sim.Schedule(std::make_shared<TestEvent>(15.0, &exec_time2));
+  sim.Schedule(std::make_unique<TestEvent>(5.0, &exec_time1));
+  sim.Schedule(std::make_unique<TestEvent>(15.0, &exec_time2));
 
   sim.Run(10.0);  // Stop before second event
 
@@ -108,8 +123,7 @@ TEST_CASE("Simulator cancel event", "[simulator]") {
   Simulator sim;
   double exec_time = -1.0;
 
-  auto event = std::make_shared<TestEvent>(5.0, &exec_time);
-  sim.Schedule(event);
+  Event* event = sim.Schedule(std::make_unique<TestEvent>(5.0, &exec_time));
   event->Cancel();
 
   sim.Run();
@@ -122,13 +136,25 @@ TEST_CASE("Simulator chained events", "[simulator]") {
   Simulator sim;
   int counter = 0;
 
-  sim.Schedule(std::make_shared<ChainEvent>(1.0, &counter, 5));
+  sim.Schedule(std::make_unique<ChainEvent>(1.0, &counter, 5));
   sim.Run();
 
   REQUIRE(counter == 5);
   REQUIRE(sim.Now() == 5.0);
 }
 
+// Test self-rescheduling via Reschedule
+TEST_CASE("Simulator rescheduled event", "[simulator]") {
+  Simulator sim;
+  int counter = 0;
+
+  sim.Schedule(std::make_unique<RepeatingEvent>(1.0, &counter, 4));
+  sim.Run();
+
+  REQUIRE(counter == 4);
+  REQUIRE(sim.Now() == 7.0);  // 1.0 + 3 * 2.0
+}
+
 // Test empty simulator
 TEST_CASE("Simulator empty run", "[simulator]") {
   Simulator sim;
@@ -141,9 +167,38 @@ TEST_CASE("Simulator run until empty", "[simulator]") {
   Simulator sim;
   double exec_time = -1.0;
 
-  sim.Schedule(std::make_shared<TestEvent>(100.0, &exec_time));
+  sim.Schedule(std::make_unique<TestEvent>(100.0, &exec_time));
   sim.Run(-1.0);  // Negative means no limit
 
   REQUIRE(exec_time == 100.0);
   REQUIRE(sim.Now() == 100.0);
 }
+
+// Test scheduling a callable directly, without an Event subclass
+TEST_CASE("Simulator lambda event", "[simulator]") {
+  Simulator sim;
+  double fired_at = -1.0;
+
+  sim.Schedule(3.0, [&fired_at](Simulator& s) { fired_at = s.Now(); });
+  sim.Run();
+
+  REQUIRE(fired_at == 3.0);
+  REQUIRE(sim.Now() == 3.0);
+}
+
+// Test lambda events can schedule further work and be cancelled
+TEST_CASE("Simulator lambda event chains and cancels", "[simulator]") {
+  Simulator sim;
+  int executed = 0;
+
+  sim.Schedule(1.0, [&executed](Simulator& s) {
+    ++executed;
+    s.Schedule(1.0, [&executed](Simulator&) { ++executed; });
+  });
+  Event* doomed = sim.Schedule(5.0, [&executed](Simulator&) { ++executed; });
+  doomed->Cancel();
+  sim.Run();
+
+  REQUIRE(executed == 2);
+  REQUIRE(sim.Now() == 2.0);
+}
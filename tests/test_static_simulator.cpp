@@ -0,0 +1,88 @@
+/**
+ * @file test_static_simulator.cpp
+ * @brief Unit tests for the StaticSimulator class
+ */
+
+#include <desvu/desvu.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace desvu;
+
+namespace {
+
+struct Recorder;
+struct Chainer;
+using Sim = StaticSimulator<Recorder, Chainer>;
+
+// Event that records when it executes
+struct Recorder {
+  double delay;
+  double* execution_time;
+
+  void Action(Sim& sim) { *execution_time = sim.Now(); }
+};
+
+// Event that schedules a successor of itself
+struct Chainer {
+  double delay;
+  int* counter;
+  int max_count;
+
+  void Action(Sim& sim) {
+    (*counter)++;
+    if (*counter < max_count) {
+      sim.Schedule(Chainer{1.0, counter, max_count});
+    }
+  }
+};
+
+}  // namespace
+
+// Test basic creation and time
+TEST_CASE("StaticSimulator initial time", "[static_simulator]") {
+  Sim sim;
+  REQUIRE(sim.Now() == 0.0);
+}
+
+// Test events execute in chronological order with tie-break by insertion
+TEST_CASE("StaticSimulator event order", "[static_simulator]") {
+  Sim sim;
+  double exec_time1 = -1.0, exec_time2 = -1.0;
+
+  sim.Schedule(Recorder{10.0, &exec_time1});
+  sim.Schedule(Recorder{5.0, &exec_time2});
+
+  sim.Run();
+
+  REQUIRE(exec_time2 == 5.0);
+  REQUIRE(exec_time1 == 10.0);
+  REQUIRE(sim.Now() == 10.0);
+}
+
+// Test run with time limit
+TEST_CASE("StaticSimulator run with time limit", "[static_simulator]") {
+  Sim sim;
+  double exec_time1 = -1.0, exec_time2 = -1.0;
+
+  sim.Schedule(Recorder{5.0, &exec_time1});
+  sim.Schedule(Recorder{15.0, &exec_time2});
+
+  sim.Run(10.0);
+
+  REQUIRE(exec_time1 == 5.0);
+  REQUIRE(exec_time2 == -1.0);  // Not executed
+  REQUIRE(sim.Now() == 10.0);
+}
+
+// Test chained event scheduling across the variant
+TEST_CASE("StaticSimulator chained events", "[static_simulator]") {
+  Sim sim;
+  int counter = 0;
+
+  sim.Schedule(Chainer{1.0, &counter, 5});
+  sim.Run();
+
+  REQUIRE(counter == 5);
+  REQUIRE(sim.Now() == 5.0);
+}
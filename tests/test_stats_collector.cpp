@@ -233,3 +233,110 @@ TEST_CASE("StatsCollector backward time error", "[stats_collector]") {
   const auto* queue = collector.GetTimeWeighted("Queue Length");
   REQUIRE(queue->Count() == 5);  // Constructor + 4 successful updates
 }
+
+// Test that GetOrCreate returns stable handles that share state with Add
+TEST_CASE("StatsCollector get-or-create handles", "[stats_collector]") {
+  StatsCollector collector;
+
+  EventStats& waiting = collector.GetOrCreateEvent("Waiting Time");
+  waiting.Add(2.0);
+  collector.Add("Waiting Time", 4.0);
+
+  // Handle and string-keyed API observe the same statistic
+  REQUIRE(&waiting == collector.GetEvent("Waiting Time"));
+  REQUIRE(waiting.Count() == 2);
+
+  TimeWeightedStats& queue = collector.GetOrCreateTimeWeighted("Queue Length");
+  queue.Update(1.0, 3.0);
+  collector.Add("Queue Length", 2.0, 5.0);
+
+  REQUIRE(&queue == collector.GetTimeWeighted("Queue Length"));
+  REQUIRE(queue.Count() == 3);  // Constructor + 2 updates
+
+  // Repeated calls return the same object
+  REQUIRE(&collector.GetOrCreateEvent("Waiting Time") == &waiting);
+}
+
+// Test that handles stay valid while many statistics are added (the
+// internal name index rehashes as it grows)
+TEST_CASE("StatsCollector handles survive growth", "[stats_collector]") {
+  StatsCollector collector;
+
+  EventStats& first = collector.GetOrCreateEvent("First");
+  first.Add(1.0);
+
+  for (int i = 0; i < 50; ++i) {
+    collector.Add("Stat " + std::to_string(i), static_cast<double>(i));
+  }
+
+  first.Add(3.0);
+  REQUIRE(collector.GetEvent("First") == &first);
+  REQUIRE(first.Average() == 2.0);
+  REQUIRE(collector.EventNames().size() == 51);
+  REQUIRE(collector.GetEvent("Stat 49")->Average() == 49.0);
+  REQUIRE(collector.GetEvent("Missing") == nullptr);
+}
+
+// Test the registered-handle fast path shares state with the string API
+TEST_CASE("StatsCollector stat id handles", "[stats_collector]") {
+  StatsCollector collector;
+
+  StatId waiting = collector.RegisterEvent("Waiting Time");
+  collector.Add(waiting, 2.0);
+  collector.Add("Waiting Time", 4.0);
+
+  REQUIRE(collector.GetEvent("Waiting Time")->Count() == 2);
+  REQUIRE(collector.GetEvent("Waiting Time")->Average() == 3.0);
+
+  // Registering the same name again yields the same handle
+  REQUIRE(collector.RegisterEvent("Waiting Time").index == waiting.index);
+
+  StatId queue = collector.RegisterTimeWeighted("Queue Length");
+  collector.Add(queue, 1.0, 3.0);
+  collector.Add(queue, 2.0, 5.0);
+
+  REQUIRE(collector.GetTimeWeighted("Queue Length")->Count() == 3);
+  REQUIRE(collector.GetTimeWeighted("Queue Length")->LastValue() == 5.0);
+}
+
+// Test visiting names without materializing a vector
+TEST_CASE("StatsCollector for-each names", "[stats_collector]") {
+  StatsCollector collector;
+  collector.Add("Waiting Time", 5.0);
+  collector.Add("Service Time", 3.0);
+  collector.Add("Queue Length", 0.0, 1.0);
+
+  std::size_t event_count = 0;
+  collector.ForEachEventName([&](std::string_view name) {
+    REQUIRE((name == "Waiting Time" || name == "Service Time"));
+    ++event_count;
+  });
+  REQUIRE(event_count == 2);
+
+  std::size_t tw_count = 0;
+  collector.ForEachTimeWeightedName([&](std::string_view name) {
+    REQUIRE(name == "Queue Length");
+    ++tw_count;
+  });
+  REQUIRE(tw_count == 1);
+}
+
+// Test batch insertion through the collector
+TEST_CASE("StatsCollector add range", "[stats_collector]") {
+  StatsCollector batched;
+  StatsCollector single;
+
+  const double values[] = {1.0, 2.0, 3.0, 4.0, 5.0};
+  batched.AddRange("Waiting Time", values, 5);
+  for (double v : values) single.Add("Waiting Time", v);
+
+  const EventStats* a = batched.GetEvent("Waiting Time");
+  const EventStats* b = single.GetEvent("Waiting Time");
+  REQUIRE(a != nullptr);
+  REQUIRE(b != nullptr);
+  REQUIRE(a->Count() == 5);
+  REQUIRE(a->Average() == b->Average());
+  REQUIRE(a->StandardDeviation() == b->StandardDeviation());
+  REQUIRE(a->Min() == 1.0);
+  REQUIRE(a->Max() == 5.0);
+}